@@ -20,6 +20,7 @@
 //NOTE! For instructions and more information, please examine NS73.h.
 
 #include "NS73.h"
+#include <avr/sleep.h>
 
 NS73Class NS73;
 
@@ -133,7 +134,7 @@ void NS73Class::setCEX(const uint8_t value)
 	if( (reg[8] & 0x3) != value )
 	{
 		updateRegister(8, (reg[8] & 0xFC) | (value & 0x3) );
-		delay(175); //TODO: Verify this value.
+		wait(175000UL); //TODO: Verify this value.
 	}
 }
 
@@ -158,7 +159,7 @@ void NS73Class::cexSeek(const uint8_t chan)
 	for( newCEX = 3; newCEX >= 0; newCEX-- )
 	{
 		setCEX(newCEX);
-		delay(500);	//TODO: Determine a better time.
+		wait(500000UL);	//TODO: Determine a better time.
 		
 		if( haveTEBLock() )
 		{
@@ -284,12 +285,46 @@ uint8_t NS73Class::haveTEBLock(void)
 	{
 		if( digitalRead(teb) == HIGH )
 			checkCount++;
-		delayMicroseconds(2500);
+		wait(2500);
 	}
 	
 	return (checkCount > 25);
 }
 
+//Stands in for delay() while the synthesizer settles. The CPU is put into idle sleep and
+//woken by the Timer0 overflow tick; the last tick (plus a little slack) is spun out so that TEB
+//samples stay on schedule at any clock speed. Falls back to spinning if interrupts are disabled,
+//since nothing would wake us. The caller's sleep mode in SMCR is preserved.
+void NS73Class::wait(const unsigned long us)
+{
+	const long spinMargin = clockCyclesToMicroseconds(64UL * 256) + 100;	//One Timer0 overflow period.
+	unsigned long wakeAt = micros() + us;
+	uint8_t smcr;
+	
+	while( (long)(wakeAt - micros()) > 0 )
+	{
+		if( (SREG & _BV(SREG_I)) && (long)(wakeAt - micros()) > spinMargin )
+		{
+			smcr = SMCR;
+			set_sleep_mode(SLEEP_MODE_IDLE);
+			sleep_mode();
+			SMCR = smcr;
+		}
+	}
+}
+
+//Reports whether an EEPROM write (the driver's or the sketch's) is still in flight. Callers should only
+//compare the result with NOWAKE: anything else is the fixed upper bound epWriteMillis, not a countdown.
+//NOWAKE means the MCU may sleep until an external event (e.g. TEB changing). Synthesizer waits happen
+//inside the blocking calls and are never reported here.
+unsigned long NS73Class::nextWake(void)
+{
+	if( EECR & _BV(EEPE) )	//An EEPROM write is still in flight.
+		return epWriteMillis;
+	
+	return NOWAKE;
+}
+
 uint8_t NS73Class::getRegister(const uint8_t which)
 {
 	return reg[which]; 
@@ -40,6 +40,13 @@
  pretty good and has worked for many chips. If it fails to get a frequency lock when changing channels, the
  driver will attempt to adjust the oscillator. This might take two full seconds! If it succeeds, it will
  modify the calibration table and future channel changes will happen much faster.
+ - While the driver waits on the synthesizer (CEX settling, TEB lock sampling) it idles the CPU instead of
+ spinning in delay(). Those deadlines are consumed inside the blocking call and are never published; by the
+ time setChannel() and friends return, the synthesizer work is done. The only thing that can still be
+ outstanding is an EEPROM write, which is what nextWake() reports. Only compare its result with NOWAKE:
+ while any EEPROM write is in flight it returns the fixed bound epWriteMillis, which does not count down.
+ When nextWake() returns NOWAKE it is safe to put the MCU into power-down sleep until a button or TEB pin
+ change. The sample sketch shows one way to do this.
 
  CONNECTING TO YOUR ARDUINO:
  To use an NS73 breakout board from Sparkfun in your Arduino project, connect its power to the arduino's 3.3v
@@ -111,6 +118,12 @@ enum
 
 static const uint8_t MAX_REG = 9;
 
+//Returned by nextWake() when no EEPROM write is in flight.
+static const unsigned long NOWAKE = 0xFFFFFFFFUL;
+
+//Worst-case EEPROM write time, rounded up from the 3.3ms given in the ATMega328P datasheet.
+static const unsigned long epWriteMillis = 4;
+
 //EEPROM constants
 static const uint8_t epMagicOffset = 0x95;
 static const uint8_t epMagic = 0x56;
@@ -159,6 +172,7 @@ private:
 	void cexSeek(const uint8_t chan);
 	uint8_t cexLookup(const uint8_t chan);
 	uint8_t haveTEBLock(void);
+	void wait(const unsigned long us);
 	uint16_t freqLookup(const uint8_t chan);
 	void ModifyCEXTable(const uint8_t chan, const uint8_t value);
 	void EEPROMWrite(const uint16_t address, const uint8_t value);
@@ -179,6 +193,7 @@ public:
 	void goOnline(void);
 	void goOffline(void);
 	uint8_t onAir(void);
+	unsigned long nextWake(void);
 	void mute(void);
 	void unMute(void);
 	void setInputAttenuation(const uint8_t to);
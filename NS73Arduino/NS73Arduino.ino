@@ -2,6 +2,8 @@
 //by Conor Peterson, 2012 (conor.p.peterson@gmail.com)
 
 #include <EEPROM.h>
+#include <avr/sleep.h>
+#include <avr/interrupt.h>
 #include "NS73.h"
 
 const byte channelOffset = 0x20;
@@ -14,8 +16,27 @@ const byte ns73LatchPin = 4;
 const byte ns73TEBPin = 5;
 const byte downButton = 8;
 const byte upButton = 9;
+const unsigned int resetHoldTime = 500;  //ms both buttons must be held to reset the channel.
 
-unsigned int resetCounter = 0;
+unsigned long resetStarted = 0;
+byte resetHeld = false;
+volatile byte wakePending = false;
+byte canPowerDown = false;  //Only if every wake pin has a pin change interrupt.
+
+//Pin change interrupts wake the MCU. They also flag the edge so that one arriving after loop()
+//has read the pins, but before it goes to sleep, isn't slept through.
+//PCINT0 covers the buttons (port B) and PCINT2 covers TEB (port D) on the ATMega328P.
+ISR(PCINT0_vect)
+{
+  wakePending = true;
+}
+
+#ifdef PCINT2_vect
+ISR(PCINT2_vect)
+{
+  wakePending = true;
+}
+#endif
 
 void setup(void)
 {
@@ -39,10 +60,18 @@ void setup(void)
     NS73.setChannel(channel);
 
   NS73.goOnline();
+
+  //Wake from sleep on either button or a change in TEB lock. If any of them can't be armed
+  //(e.g. on a Mega or Leonardo) the sketch never powers down, only idles.
+  canPowerDown = enableWakePin(downButton);
+  canPowerDown &= enableWakePin(upButton);
+  canPowerDown &= enableWakePin(ns73TEBPin);
 }
 
 void loop(void)
 {  
+  wakePending = false;  //Cleared before the pins are read; any later edge is caught in sleepUntilWake().
+
   byte down = digitalRead(downButton);
   byte up = digitalRead(upButton);
     
@@ -52,14 +81,18 @@ void loop(void)
     digitalWrite(onAirIndicator, LOW);
 
   //In this basic implementation, Up moves the frequency up one channel, Down functions similarly.
-  //If both buttons are held a reset counter is incremented. When the counter reaches a high number,
-  //the channel is reset to default. Button debouncing is accomplished through software delays.
+  //If both buttons are held for resetHoldTime ms the channel is reset to default.
+  //Button debouncing is accomplished through software delays.
   if( down == LOW && up == LOW )
   {
-    resetCounter++;
-    if( resetCounter == 32000 )
+    if( !resetHeld )
+    {
+      resetHeld = true;
+      resetStarted = millis();
+    }
+    else if( millis() - resetStarted >= resetHoldTime )
     {
-      resetCounter = 0;
+      resetHeld = false;
       NS73.setFrequency(defaultFrequency);
       digitalWrite(onAirIndicator, LOW);
       delay(3000);
@@ -68,7 +101,7 @@ void loop(void)
   }
   else
   {
-    resetCounter = 0;
+    resetHeld = false;
 
     if( down == LOW )
     {
@@ -89,6 +122,48 @@ void loop(void)
       delay(250);
     }
   }
+
+  //A held button still needs servicing (auto-repeat, reset timer), so only idle in that case.
+  sleepUntilWake(down == LOW || up == LOW);
+}
+
+//Sleep until something needs attention. Power-down stops Timer0 (and with it millis()), so it
+//is only used when no button is held, the driver has nothing pending and every wake pin is
+//armed. Otherwise the CPU idles and the Timer0 tick wakes it. Pin changes wake it from either mode.
+void sleepUntilWake(byte busy)
+{
+  unsigned long wake = NS73.nextWake();
+
+  cli();
+  if( wakePending )  //A pin changed since loop() read it; go around again rather than sleep on stale readings.
+  {
+    sei();
+    return;
+  }
+
+  if( busy || wake != NOWAKE || !canPowerDown )
+    set_sleep_mode(SLEEP_MODE_IDLE);
+  else
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+  sleep_enable();
+  sei();
+  sleep_cpu();  //The instruction after sei() always runs, so an edge arriving after cli() still wakes us.
+  sleep_disable();
+}
+
+//Not every pin has a pin change interrupt on every board (e.g. pin 5 on a Leonardo).
+//Returns true if the pin was armed, false if it has none.
+byte enableWakePin(byte pin)
+{
+  volatile uint8_t *pcmsk = digitalPinToPCMSK(pin);
+  volatile uint8_t *pcicr = digitalPinToPCICR(pin);
+
+  if( pcmsk == 0 || pcicr == 0 )
+    return false;
+
+  *pcmsk |= _BV(digitalPinToPCMSKbit(pin));
+  *pcicr |= _BV(digitalPinToPCICRbit(pin));
+  return true;
 }
 
 void saveChannel(void)